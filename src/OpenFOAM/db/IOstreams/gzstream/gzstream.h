@@ -95,6 +95,7 @@ public:
    }
    gzstreambuf* open( const char* name, int open_mode );
    gzstreambuf* close();
+   int setparams( int level, int strategy = Z_DEFAULT_STRATEGY);
    virtual int     overflow( int c = EOF );
    virtual int     underflow();
    virtual int     sync();